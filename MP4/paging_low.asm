@@ -29,4 +29,36 @@ _write_cr3:
 	mov eax, [ebp+8]
 	mov cr3, eax
 	pop ebp
-	retn
\ No newline at end of file
+	retn
+
+global _read_cr4
+_read_cr4:
+	mov eax, cr4
+	retn
+
+global _write_cr4
+_write_cr4:
+	push ebp
+	mov ebp, esp
+	mov eax, [ebp+8]
+	mov cr4, eax
+	pop ebp
+	retn
+
+global _cpuid_features
+_cpuid_features:
+	push ebx
+	mov eax, 1
+	cpuid
+	mov eax, edx
+	pop ebx
+	retn
+
+global _invalidate_page
+_invalidate_page:
+	push ebp
+	mov ebp, esp
+	mov eax, [ebp+8]
+	invlpg [eax]
+	pop ebp
+	retn